@@ -825,6 +825,13 @@ macro(process_options)
     endif()
   endif()
 
+  set(ENABLE_MTP FALSE)
+  if(${NS3_MTP})
+    message(STATUS "Multithreaded parallel simulation support enabled.")
+    add_definitions(-DNS3_MTP)
+    set(ENABLE_MTP TRUE)
+  endif()
+
   mark_as_advanced(Boost_INCLUDE_DIR)
   find_package(Boost)
   if(${Boost_FOUND})
@@ -1153,6 +1160,10 @@ macro(process_options)
     list(REMOVE_ITEM libs_to_build mpi)
   endif()
 
+  if(NOT ${ENABLE_MTP})
+    list(REMOVE_ITEM libs_to_build mtp)
+  endif()
+
   if(NOT ${ENABLE_VISUALIZER})
     list(REMOVE_ITEM libs_to_build visualizer)
   endif()
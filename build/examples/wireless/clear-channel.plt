@@ -0,0 +1,190 @@
+set terminal postscript eps color enh "Times-BoldItalic"
+set output "clear-channel.eps"
+set xlabel "RSS(dBm)"
+set ylabel "Number of packets received"
+set xrange [-102:-83]
+plot "-"  title "DsssRate1Mbps" with lines, "-"  title "DsssRate2Mbps" with lines, "-"  title "DsssRate5_5Mbps" with lines, "-"  title "DsssRate11Mbps" with lines
+-102 0
+-101.5 0
+-101 0
+-100.5 0
+-100 0
+-99.5 0
+-99 0
+-98.5 0
+-98 0
+-97.5 0
+-97 0
+-96.5 0
+-96 0
+-95.5 0
+-95 0
+-94.5 0
+-94 0
+-93.5 0
+-93 0
+-92.5 0
+-92 0
+-91.5 0
+-91 0
+-90.5 0
+-90 0
+-89.5 0
+-89 0
+-88.5 0
+-88 0
+-87.5 0
+-87 0
+-86.5 0
+-86 0
+-85.5 0
+-85 0
+-84.5 0
+-84 0
+-83.5 0
+-83 0
+-82.5 0
+-82 0
+-81.5 200
+-81 200
+-80.5 200
+-80 200
+e
+-102 0
+-101.5 0
+-101 0
+-100.5 0
+-100 0
+-99.5 0
+-99 0
+-98.5 0
+-98 0
+-97.5 0
+-97 0
+-96.5 0
+-96 0
+-95.5 0
+-95 0
+-94.5 0
+-94 0
+-93.5 0
+-93 0
+-92.5 0
+-92 0
+-91.5 0
+-91 0
+-90.5 0
+-90 0
+-89.5 0
+-89 0
+-88.5 0
+-88 0
+-87.5 0
+-87 0
+-86.5 0
+-86 0
+-85.5 0
+-85 0
+-84.5 0
+-84 0
+-83.5 0
+-83 0
+-82.5 0
+-82 0
+-81.5 200
+-81 200
+-80.5 200
+-80 200
+e
+-102 0
+-101.5 0
+-101 0
+-100.5 0
+-100 0
+-99.5 0
+-99 0
+-98.5 0
+-98 0
+-97.5 0
+-97 0
+-96.5 0
+-96 0
+-95.5 0
+-95 0
+-94.5 0
+-94 0
+-93.5 0
+-93 0
+-92.5 0
+-92 0
+-91.5 0
+-91 0
+-90.5 0
+-90 0
+-89.5 0
+-89 0
+-88.5 0
+-88 0
+-87.5 0
+-87 0
+-86.5 0
+-86 0
+-85.5 0
+-85 0
+-84.5 0
+-84 0
+-83.5 0
+-83 0
+-82.5 0
+-82 0
+-81.5 0
+-81 0
+-80.5 0
+-80 0
+e
+-102 0
+-101.5 0
+-101 0
+-100.5 0
+-100 0
+-99.5 0
+-99 0
+-98.5 0
+-98 0
+-97.5 0
+-97 0
+-96.5 0
+-96 0
+-95.5 0
+-95 0
+-94.5 0
+-94 0
+-93.5 0
+-93 0
+-92.5 0
+-92 0
+-91.5 0
+-91 0
+-90.5 0
+-90 0
+-89.5 0
+-89 0
+-88.5 0
+-88 0
+-87.5 0
+-87 0
+-86.5 0
+-86 0
+-85.5 0
+-85 0
+-84.5 0
+-84 0
+-83.5 0
+-83 0
+-82.5 0
+-82 0
+-81.5 0
+-81 0
+-80.5 0
+-80 0
+e